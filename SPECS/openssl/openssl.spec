@@ -4,7 +4,7 @@
 Summary:        Utilities from the general purpose cryptography library with TLS implementation
 Name:           openssl
 Version:        1.1.1k
-Release:        1%{?dist}
+Release:        45%{?dist}
 License:        OpenSSL
 Vendor:         Microsoft Corporation
 Distribution:   Mariner
@@ -40,6 +40,31 @@ Patch17:        openssl-1.1.1-kdf-selftest.patch
 Patch18:        openssl-1.1.1-rewire-fips-drbg.patch
 Patch19:        openssl-1.1.1-fips-curves.patch
 Patch20:        openssl-1.1.1-sp80056arev3.patch
+Patch21:        openssl-1.1.1-rand-prefetch.patch
+Patch22:        openssl-1.1.1-post-reseed-async.patch
+Patch23:        openssl-1.1.1-rand-cache.patch
+Patch24:        openssl-1.1.1-drbg-selftest-lite.patch
+Patch25:        openssl-1.1.1-rand-stats.patch
+Patch26:        openssl-1.1.1-pbkdf2-mb.patch
+Patch27:        openssl-1.1.1-scrypt-mt.patch
+Patch28:        openssl-1.1.1-kdf-reuse.patch
+Patch29:        openssl-1.1.1-sshkdf-all.patch
+Patch30:        openssl-1.1.1-kbkdf-mb.patch
+Patch31:        openssl-1.1.1-speed-kdf.patch
+Patch32:        openssl-1.1.1-sskdf-mb.patch
+Patch33:        openssl-1.1.1-dh-short-exp.patch
+Patch34:        openssl-1.1.1-dh-named-mont.patch
+Patch35:        openssl-1.1.1-dh-named-check.patch
+Patch36:        openssl-1.1.1-ec-pubcheck-cofactor.patch
+Patch37:        openssl-1.1.1-ec-scratch-ctx.patch
+Patch38:        openssl-1.1.1-ec-fips-pct.patch
+Patch39:        openssl-1.1.1-keyshare-pool.patch
+Patch40:        openssl-1.1.1-sigalg-tables.patch
+Patch41:        openssl-1.1.1-rsa-mt-keygen.patch
+Patch42:        openssl-1.1.1-dsa-mt-paramgen.patch
+Patch43:        openssl-1.1.1-bn-ctx-cache.patch
+Patch44:        openssl-1.1.1-secure-heap-cache.patch
+Patch45:        openssl-1.1.1-x25519-x448-mb.patch
 BuildRequires:  perl-Test-Warnings
 BuildRequires:  perl-Text-Template
 Requires:       %{name}-libs = %{version}-%{release}
@@ -126,6 +151,31 @@ cp %{SOURCE4} test/
 %patch18 -p1
 %patch19 -p1
 %patch20 -p1
+%patch21 -p1
+%patch22 -p1
+%patch23 -p1
+%patch24 -p1
+%patch25 -p1
+%patch26 -p1
+%patch27 -p1
+%patch28 -p1
+%patch29 -p1
+%patch30 -p1
+%patch31 -p1
+%patch32 -p1
+%patch33 -p1
+%patch34 -p1
+%patch35 -p1
+%patch36 -p1
+%patch37 -p1
+%patch38 -p1
+%patch39 -p1
+%patch40 -p1
+%patch41 -p1
+%patch42 -p1
+%patch43 -p1
+%patch44 -p1
+%patch45 -p1
 
 %build
 # Add -Wa,--noexecstack here so that libcrypto's assembler modules will be
@@ -320,6 +370,138 @@ rm -rf %{buildroot}
 
 
 %changelog
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-45
+- Do not cache secure BN_CTXs while the secure heap is initialized
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-44
+- Evaluate the DSA paramgen counters from the seed the serial search left, parse dsa_paramgen_threads strictly
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-43
+- Keep the threaded RSA prime search equal to the serial one over retries, parse rsa_keygen_threads strictly
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-42
+- Stop the key share pool workers at OPENSSL_cleanup() and document EVP_PKEY_POOL
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-41
+- Document the ECDH-only EC keygen control and test the pairwise test it selects
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-40
+- Give DH parameter copies of the named groups the static Montgomery context
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-39
+- Use the multi-buffer SHA lanes only on processors with SSSE3
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-38
+- Export the multi-buffer X25519/X448 API and pool X25519/X448 key shares
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-37
+- Drain the secure heap caches of all threads when the heap runs out, test the cache
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-36
+- Cache at most one small secure BN_CTX per thread, test the BN_CTX cache
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-35
+- Report negative dsa_paramgen_threads values on the error queue, test threaded DSA paramgen
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-34
+- Test that the threaded FIPS RSA key generation gives the single-thread key
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-33
+- Stop the key share pool worker around fork() and add pool tests
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-32
+- Keep a caller-set DH private key length, add an internal test for the g = 2 exponentiation
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-31
+- Time the speed kdf runs on the wall clock and reap the -multi children
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-30
+- Round the scrypt huge page mappings to whole pages so the unused tail is unmapped
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-29
+- Fall back to EVP in the multi-buffer SHA lanes after a failed FIPS selftest
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-28
+- Bypass the RAND_bytes() output cache in FIPS mode
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-27
+- Make the asynchronous post-POST reseed opt-in (OPENSSL_RAND_ASYNC_RESEED) and join it before fork()
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-26
+- Multi-buffer X25519 (AVX-512 IFMA) and X448 (AVX2) with runtime dispatch
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-25
+- Per-thread cache of small secure heap blocks in front of sec_malloc_lock
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-24
+- Per-thread cache of free BN_CTXs behind BN_CTX_new and BN_CTX_free
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-23
+- Opt-in multi-threaded search for p in DSA parameter generation
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-22
+- Opt-in multi-threaded prime search for FIPS RSA key generation
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-21
+- Filter the default signature algorithms and groups once per SSL_CTX
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-20
+- Add an opt-in per-SSL_CTX pool of pregenerated ECDHE key shares
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-19
+- Cheaper FIPS pairwise consistency test of generated EC keys, Q = d * G for TLS key shares
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-18
+- Borrow a per-thread scratch BN_CTX for EC key generation and ECDH
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-17
+- Skip the order multiplication of EC public key validation for cofactor 1 curves
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-16
+- Skip the primality tests of DH_check() for the named DH groups
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-15
+- Use static Montgomery contexts for the named DH groups
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-14
+- Use security strength sized private keys for named DH groups and a constant-time g = 2 exponentiation
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-13
+- Compute SSKDF counter blocks with SHA-1/SHA-2 in multi-buffer lanes
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-12
+- Add 'openssl speed kdf' and per-KDF benchmarks reporting derives/s and bytes/s, with -multi
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-11
+- Compute KBKDF counter mode HMAC blocks in multi-buffer lanes from precomputed pad states
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-10
+- Add EVP_KDF_SSHKDF_TYPE_ALL to derive all six SSH keys in one multi-buffer pass
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-9
+- Reuse keyed HMAC/digest state and buffers across HKDF, TLS1-PRF and SSHKDF derivations
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-8
+- Add EVP_KDF_CTRL_SET_SCRYPT_THREADS, SSE2 Salsa20/8 and huge page backed scratch memory to scrypt.
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-7
+- Compute PBKDF2 with SHA-1/SHA-2 on precomputed HMAC states in multi-buffer lanes, add EVP_KDF_derive_batch()
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-6
+- Add optional RNG hot path statistics (OPENSSL_RAND_STATS, RAND_DRBG_get_stat())
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-5
+- Run the DRBG KATs on a single stack-allocated DRBG from one shared table
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-4
+- Add opt-in per-thread output cache for small RAND_bytes() requests
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-3
+- Reseed the DRBGs on a helper thread after the FIPS selftest
+
+* Sun Oct 18 2026 CBL-Mariner Servicing Account <cblmargh@microsoft.com> - 1.1.1k-2
+- Serve small getrandom() requests from a fork-safe prefetch buffer
+
 * Mon Mar 29 2021 Nicolas Ontiveros <niontive@microsoft.com> - 1.1.1k-1
 - Update to version 1.1.1k
 